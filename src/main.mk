@@ -33,8 +33,11 @@ SOURCES      := AS_global.C \
                 AS_UTL/AS_UTL_stackTrace.C \
                 \
                 AS_UTL/AS_UTL_alloc.C \
+                AS_UTL/asyncRead.C \
                 \
+                AS_UTL/baseEncoding.C \
                 AS_UTL/bitEncodings.C \
+                AS_UTL/bitPacking.C \
                 AS_UTL/bitPackedFile.C \
                 AS_UTL/bitPackedArray.C \
                 AS_UTL/dnaAlphabets.C \
@@ -43,8 +46,13 @@ SOURCES      := AS_global.C \
                 AS_UTL/memoryMappedFile.C \
                 AS_UTL/mt19937ar.C \
                 AS_UTL/readBuffer.C \
+                AS_UTL/runStats.C \
+                AS_UTL/scratchArena.C \
                 AS_UTL/speedCounter.C \
                 AS_UTL/sweatShop.C \
+                AS_UTL/threadPool.C \
+                AS_UTL/compressedFile.C \
+                AS_UTL/lineReader.C \
                 AS_UTL/timeAndSize.C \
                 AS_UTL/kMer.C \
                 \
@@ -59,12 +67,16 @@ SOURCES      := AS_global.C \
                 stores/gkStoreInfo.C \
                 stores/gkStoreEncode.C \
                 stores/gkStorePartition.C \
+                stores/gkStoreBatch.C \
+                stores/gkReadCache.C \
+                stores/gkStoreBlobBlocks.C \
                 \
                 stores/ovOverlap.C \
                 stores/ovStore.C \
                 stores/ovStoreWriter.C \
                 stores/ovStoreFilter.C \
                 stores/ovStoreFile.C \
+                stores/ovOverlapSort.C \
                 stores/ovStoreHistogram.C \
                 \
                 stores/tgStore.C \
@@ -747,6 +747,7 @@ sub dumpCorrectedReads ($) {
     $cmd .= "  -corrected \\\n";
     $cmd .= "  -G ./$asm.gkpStore \\\n";
     $cmd .= "  -o ./$asm.correctedReads.gz \\\n";
+    $cmd .= "  -threads " . getGlobal("executiveThreads") . " \\\n";
     $cmd .= "  -fasta \\\n";
     $cmd .= "  -nolibname \\\n";
     $cmd .= "> $asm.correctedReads.fasta.err 2>&1";
@@ -830,6 +830,7 @@ sub setDefaults () {
 
     setDefault("gridOptions",           undef,  "Grid engine options applied to all jobs");
     setDefault("gridOptionsExecutive",  undef,  "Grid engine options applied to the canu executive script");
+    setDefault("executiveThreads",      1,      "Number of threads the canu executive script uses, and reserves from the grid, for its own work");
     setDefault("gridOptionsJobName",    undef,  "Grid jobs job-name suffix");
 
     #####  Grid Engine configuration and parameters, for each step of the pipeline (memory, threads)
@@ -647,16 +647,18 @@ sub submitScript ($$) {
 
     $jobName   = makeUniqueJobName("canu", $asm);
 
-    #  The canu.pl script isn't expected to take resources.  We'll default to 4gb and one thread.
+    #  The canu.pl script isn't expected to take resources.  We'll default to 4gb and
+    #  executiveThreads (one, unless set), used when dumping corrected and trimmed reads.
 
     my $mem = 4;
-    my $thr = 1;
+    my $thr = getGlobal("executiveThreads");
 
     #  However, the sequential overlap store is still built from within the canu process.
 
     if (getGlobal("ovsMethod") eq "sequential") {
         $mem = getGlobal("ovsMemory");
         $mem = $2  if ($mem =~ m/^(\d+)-(\d+)$/);
+        $thr = getGlobal("ovsThreads")  if (getGlobal("ovsThreads") > $thr);
     }
 
     $memOption = buildMemoryOption($mem, 1);
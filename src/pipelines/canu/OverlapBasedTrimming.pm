@@ -263,6 +263,7 @@ sub dumpTrimmedReads ($) {
     $cmd .= "  -trimmed \\\n";
     $cmd .= "  -G ./$asm.gkpStore \\\n";
     $cmd .= "  -o ./$asm.trimmedReads.gz \\\n";
+    $cmd .= "  -threads " . getGlobal("executiveThreads") . " \\\n";
     $cmd .= "  -fasta \\\n";
     $cmd .= "  -nolibname \\\n";
     $cmd .= "> ./$asm.trimmedReads.fasta.err 2>&1";
@@ -98,6 +98,7 @@ sub createOverlapStoreSequential ($$$) {
     $cmd .= " -O ./$asm.ovlStore.BUILDING \\\n";
     $cmd .= " -G ./$asm.gkpStore \\\n";
     $cmd .= " -M $memSize \\\n";
+    $cmd .= " -threads " . getGlobal("ovsThreads") . " \\\n";
     $cmd .= " -L ./1-overlapper/ovljob.files \\\n";
     $cmd .= " > ./$asm.ovlStore.err 2>&1";
 
@@ -313,6 +314,7 @@ sub overlapStoreConfigure ($$$) {
         print F "\$bin/ovStoreSorter \\\n";
         print F "  -deletelate \\\n";  #  Choices -deleteearly -deletelate or nothing
         print F "  -M $memLimit \\\n";
+        print F "  -threads " . getGlobal("ovsThreads") . " \\\n";
         print F "  -O . \\\n";
         print F "  -G ../$asm.gkpStore \\\n";
         print F "  -F $numSlices \\\n";